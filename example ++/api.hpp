@@ -88,6 +88,9 @@ namespace Faerion {
                     {"user_agent", user_agent}
                 };
             }
+
+            NLOHMANN_DEFINE_TYPE_INTRUSIVE_WITH_DEFAULT(LogEntry, timestamp, username, license_key, hwid, pc_name,
+                event_type, description, ip_address, app_version, status_code, user_agent)
         };
 
         // ===============================
@@ -119,6 +122,9 @@ namespace Faerion {
                     {"running_processes", running_processes}
                 };
             }
+
+            NLOHMANN_DEFINE_TYPE_INTRUSIVE_ONLY_SERIALIZE(PCInfo, hostname, hwid, os_version, cpu_name, memory_amount,
+                gpu_info, disk_space, installed_programs, network_adapters, running_processes)
         };
 
         // ===============================
@@ -140,6 +146,8 @@ namespace Faerion {
                     {"module_name", module_name}
                 };
             }
+
+            NLOHMANN_DEFINE_TYPE_INTRUSIVE_WITH_DEFAULT(UserAction, timestamp, action_name, action_details, result, module_name)
         };
 
     private:
@@ -380,10 +388,9 @@ namespace Faerion {
         void SavePCInfoToFile(const PCInfo& info) {
             CreateLogDirectory();
             
-            json pcData = info.to_json();
             std::ofstream file(pc_info_file_path, std::ios::out | std::ios::trunc);
             if (file.is_open()) {
-                file << pcData.dump(4);
+                json::dump_value_to(file, info, 4);
                 file.flush();
                 file.close();
             }
@@ -478,7 +485,7 @@ namespace Faerion {
             // Write back to file
             std::ofstream outFile(log_file_path, std::ios::out | std::ios::trunc);
             if (outFile.is_open()) {
-                outFile << allLogs.dump(4);
+                allLogs.dump_to(outFile, 4);
                 outFile.flush();
                 outFile.close();
             }
@@ -520,7 +527,7 @@ namespace Faerion {
             // Write back to file
             std::ofstream outFile(action_log_path, std::ios::out | std::ios::trunc);
             if (outFile.is_open()) {
-                outFile << allActions.dump(4);
+                allActions.dump_to(outFile, 4);
                 outFile.flush();
                 outFile.close();
             }
@@ -553,7 +560,7 @@ namespace Faerion {
             // Write all logs back to file
             std::ofstream outFile(log_file_path, std::ios::out | std::ios::trunc);
             if (outFile.is_open()) {
-                outFile << allLogs.dump(4);
+                allLogs.dump_to(outFile, 4);
                 outFile.flush();
                 outFile.close();
             }
@@ -586,7 +593,7 @@ namespace Faerion {
             // Write all actions back to file
             std::ofstream outFile(action_log_path, std::ios::out | std::ios::trunc);
             if (outFile.is_open()) {
-                outFile << allActions.dump(4);
+                allActions.dump_to(outFile, 4);
                 outFile.flush();
                 outFile.close();
             }
@@ -618,66 +625,58 @@ namespace Faerion {
         // GET LOGS (FROM FILE)
         // ===============================
         std::vector<LogEntry> GetLogs() const {
-            std::vector<LogEntry> logs;
-            
-            std::ifstream file(log_file_path);
-            if (file.is_open()) {
-                try {
-                    json logsJson;
-                    file >> logsJson;
-                    
-                    for (const auto& logJson : logsJson) {
-                        LogEntry entry;
-                        entry.timestamp = logJson.value("timestamp", "");
-                        entry.username = logJson.value("username", "");
-                        entry.license_key = logJson.value("license_key", "");
-                        entry.hwid = logJson.value("hwid", "");
-                        entry.pc_name = logJson.value("pc_name", "");
-                        entry.event_type = logJson.value("event_type", "");
-                        entry.description = logJson.value("description", "");
-                        entry.ip_address = logJson.value("ip_address", "");
-                        entry.app_version = logJson.value("app_version", "");
-                        entry.status_code = logJson.value("status_code", 0);
-                        entry.user_agent = logJson.value("user_agent", "");
-                        logs.push_back(entry);
-                    }
-                } catch (...) {
-                    // Return empty on error
-                }
-                file.close();
-            }
-            
-            return logs;
+            return ReadRecords<LogEntry>(log_file_path);
         }
 
         // ===============================
         // GET USER ACTIONS (FROM FILE)
         // =======================================
         std::vector<UserAction> GetUserActions() const {
-            std::vector<UserAction> actions;
-            
-            std::ifstream file(action_log_path);
-            if (file.is_open()) {
-                try {
-                    json actionsJson;
-                    file >> actionsJson;
-                    
-                    for (const auto& actionJson : actionsJson) {
-                        UserAction action;
-                        action.timestamp = actionJson.value("timestamp", "");
-                        action.action_name = actionJson.value("action_name", "");
-                        action.action_details = actionJson.value("action_details", "");
-                        action.result = actionJson.value("result", "");
-                        action.module_name = actionJson.value("module_name", "");
-                        actions.push_back(action);
+            return ReadRecords<UserAction>(action_log_path);
+        }
+
+        // ===============================
+        // READ RECORDS (FROM FILE)
+        // ===============================
+        // Reads a JSON array of records. A record with a member of the wrong
+        // type is skipped, and a file that was cut off while being written
+        // keeps the records before the cut; neither drops the whole file.
+        template<typename Record>
+        static std::vector<Record> ReadRecords(const std::string& path) {
+            std::vector<Record> records;
+
+            std::ifstream file(path);
+            if (!file.is_open()) {
+                return records;
+            }
+
+            try {
+                // Read the entries directly, without building a json tree
+                json::parse_into(records, file);
+                return records;
+            } catch (const json::exception&) {
+                // Read the file again, record by record
+            }
+
+            records.clear();
+            file.clear();
+            file.seekg(0);
+            json::parser_callback_t keep_valid_records = [&records](int depth, json::parse_event_t event, json& parsed) {
+                if (depth == 1 && event == json::parse_event_t::object_end) {
+                    try {
+                        records.push_back(parsed.get<Record>());
+                    } catch (const json::exception&) {
+                        // Skip a malformed record
                     }
-                } catch (...) {
-                    // Return empty on error
+                    // Converted records are not kept in the tree
+                    return false;
                 }
-                file.close();
-            }
-            
-            return actions;
+                return true;
+            };
+            const json ignored = json::parse(file, keep_valid_records, false);
+            (void)ignored;
+
+            return records;
         }
 
         // ===============================
@@ -691,14 +690,14 @@ namespace Faerion {
             
             std::ofstream logsFile(log_file_path, std::ios::out | std::ios::trunc);
             if (logsFile.is_open()) {
-                logsFile << emptyArray.dump(4);
+                emptyArray.dump_to(logsFile, 4);
                 logsFile.flush();
                 logsFile.close();
             }
             
             std::ofstream actionsFile(action_log_path, std::ios::out | std::ios::trunc);
             if (actionsFile.is_open()) {
-                actionsFile << emptyArray.dump(4);
+                emptyArray.dump_to(actionsFile, 4);
                 actionsFile.flush();
                 actionsFile.close();
             }
@@ -848,7 +847,26 @@ namespace Faerion {
             WinHttpCloseHandle(hConnect);
             WinHttpCloseHandle(hSession);
 
-            return json::parse(response, nullptr, false);
+            // a response that is not JSON, such as an HTML error page from a
+            // proxy, leaves a discarded value; see ResponseValue()
+            json result;
+            json::try_parse(response, result);
+            return result;
+        }
+
+        // ===============================
+        // RESPONSE FIELDS
+        // ===============================
+        // The default for any field of a response that was not JSON. In a
+        // JSON response, a field of the wrong type still throws type_error
+        // 302 from value(), so schema errors are not hidden.
+        template<typename T>
+        static T ResponseValue(const json& r, const char* key, const T& default_value) {
+            return r.is_discarded() ? default_value : r.value(key, default_value);
+        }
+
+        static std::string ResponseValue(const json& r, const char* key, const char* default_value) {
+            return r.is_discarded() ? std::string(default_value) : r.value(key, default_value);
         }
 
         // ===============================
@@ -866,11 +884,11 @@ namespace Faerion {
                 "Application initialized with version " + version, version);
 
             return {
-                r.value("success", false),
-                r.value("message", ""),
-                r.value("version", ""),
-                r.value("app_name", ""),
-                r.value("update_required", false)
+                ResponseValue(r, "success", false),
+                ResponseValue(r, "message", ""),
+                ResponseValue(r, "version", ""),
+                ResponseValue(r, "app_name", ""),
+                ResponseValue(r, "update_required", false)
             };
         }
 
@@ -923,6 +941,10 @@ namespace Faerion {
                     {"notes", notes}
                 };
             }
+
+            NLOHMANN_DEFINE_TYPE_INTRUSIVE_ONLY_SERIALIZE(Subscription, id, user_id, app_id, tier, status, subscription_key,
+                start_date, expiry_date, auto_renew, price, currency, billing_cycle, max_devices, max_apps,
+                priority_support, advanced_features, created_at, updated_at, last_renewal_date, notes)
         };
 
         // ===============================
@@ -939,8 +961,8 @@ namespace Faerion {
 
             json r = MakeRequest(L"/api/license", payload);
 
-            if (r.value("success", false)) {
-                token = r.value("token", "");
+            if (ResponseValue(r, "success", false)) {
+                token = ResponseValue(r, "token", "");
                 is_authenticated = true;
                 LogEvent(LogEventType::LOGIN, username, key, "User successfully authenticated with license key");
                 LogEvent(LogEventType::SESSION_START, username, key, "Session started");
@@ -963,7 +985,7 @@ namespace Faerion {
 
             json r = MakeRequest(L"/api/subscription/validate", payload);
 
-            if (r.value("success", false)) {
+            if (ResponseValue(r, "success", false)) {
                 LogEvent(LogEventType::LICENSE_VALIDATED, "", subscription_key, 
                     "Subscription key validated successfully");
             } else {
@@ -985,7 +1007,7 @@ namespace Faerion {
 
             json r = MakeRequest(L"/api/subscription/info", payload);
 
-            if (r.value("success", false)) {
+            if (ResponseValue(r, "success", false)) {
                 LogEvent(LogEventType::DATA_ACCESSED, "", subscription_key, 
                     "Subscription information retrieved");
             }
@@ -999,13 +1021,13 @@ namespace Faerion {
         bool IsSubscriptionValid(const std::string& subscription_key) {
             json response = ValidateSubscription(subscription_key);
             
-            if (!response.value("success", false)) {
+            if (!ResponseValue(response, "success", false)) {
                 return false;
             }
 
             // Check if subscription status is active
-            std::string status = response.value("status", "");
-            std::string expiry_date = response.value("expiry_date", "");
+            std::string status = ResponseValue(response, "status", "");
+            std::string expiry_date = ResponseValue(response, "expiry_date", "");
 
             if (status != "active") {
                 return false;
@@ -1023,7 +1045,7 @@ namespace Faerion {
         // ===============================
         std::string GetSubscriptionTier(const std::string& subscription_key) {
             json response = GetSubscription(subscription_key);
-            return response.value("tier", "unknown");
+            return ResponseValue(response, "tier", "unknown");
         }
 
         // ===============================
@@ -1031,7 +1053,7 @@ namespace Faerion {
         // ===============================
         int GetMaxDevices(const std::string& subscription_key) {
             json response = GetSubscription(subscription_key);
-            return response.value("max_devices", 1);
+            return ResponseValue(response, "max_devices", 1);
         }
 
         // ===============================
@@ -1039,7 +1061,7 @@ namespace Faerion {
         // ===============================
         int GetMaxApps(const std::string& subscription_key) {
             json response = GetSubscription(subscription_key);
-            return response.value("max_apps", 1);
+            return ResponseValue(response, "max_apps", 1);
         }
 
         // ===============================
@@ -1047,7 +1069,7 @@ namespace Faerion {
         // ===============================
         bool HasPrioritySupport(const std::string& subscription_key) {
             json response = GetSubscription(subscription_key);
-            return response.value("priority_support", false);
+            return ResponseValue(response, "priority_support", false);
         }
 
         // ===============================
@@ -1055,7 +1077,7 @@ namespace Faerion {
         // ===============================
         bool HasAdvancedFeatures(const std::string& subscription_key) {
             json response = GetSubscription(subscription_key);
-            return response.value("advanced_features", false);
+            return ResponseValue(response, "advanced_features", false);
         }
 
         // ===============================
@@ -1063,7 +1085,7 @@ namespace Faerion {
         // ===============================
         std::string GetExpiryDate(const std::string& subscription_key) {
             json response = GetSubscription(subscription_key);
-            return response.value("expiry_date", "unknown");
+            return ResponseValue(response, "expiry_date", "unknown");
         }
 
         // ===============================
@@ -1080,8 +1102,8 @@ namespace Faerion {
 
             json r = MakeRequest(L"/api/subscription/login", payload);
 
-            if (r.value("success", false)) {
-                token = r.value("token", "");
+            if (ResponseValue(r, "success", false)) {
+                token = ResponseValue(r, "token", "");
                 is_authenticated = true;
                 LogEvent(LogEventType::LOGIN, username, subscription_key, 
                     "User successfully authenticated with subscription key");
@@ -0,0 +1,54 @@
+//     __ _____ _____ _____
+//  __|  |   __|     |   | |  JSON for Modern C++ (supporting code)
+// |  |  |__   |  |  | | | |  version 3.11.3
+// |_____|_____|_____|_|___|  https://github.com/nlohmann/json
+//
+// SPDX-FileCopyrightText: 2013 - 2025 Niels Lohmann <https://nlohmann.me>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm> // min
+#include <chrono> // steady_clock
+#include <cstddef> // size_t
+#include <cstdio> // printf
+
+// Minimal timing for the benchmarks in this directory: report() runs a
+// function a few times and prints the best time and, given the number of
+// input bytes, the throughput.
+
+namespace json_bench
+{
+
+/// the result of @a f is accumulated so the work cannot be optimized away
+template<typename Function>
+double best_milliseconds(Function f, const int runs = 5)
+{
+    static volatile std::size_t sink = 0;
+    double best = 1e300;
+    for (int i = 0; i < runs; ++i)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        sink = sink + static_cast<std::size_t>(f());
+        const auto stop = std::chrono::steady_clock::now();
+        best = (std::min)(best, std::chrono::duration<double, std::milli>(stop - start).count());
+    }
+    return best;
+}
+
+template<typename Function>
+double report(const char* name, const std::size_t bytes, Function f, const int runs = 5)
+{
+    const double ms = best_milliseconds(f, runs);
+    if (bytes != 0)
+    {
+        std::printf("%-48s %10.2f ms %10.1f MB/s\n", name, ms, static_cast<double>(bytes) / 1e3 / ms);
+    }
+    else
+    {
+        std::printf("%-48s %10.2f ms\n", name, ms);
+    }
+    return ms;
+}
+
+}  // namespace json_bench
@@ -0,0 +1,102 @@
+//     __ _____ _____ _____
+//  __|  |   __|     |   | |  JSON for Modern C++ (supporting code)
+// |  |  |__   |  |  | | | |  version 3.11.3
+// |_____|_____|_____|_|___|  https://github.com/nlohmann/json
+//
+// SPDX-FileCopyrightText: 2013 - 2025 Niels Lohmann <https://nlohmann.me>
+// SPDX-License-Identifier: MIT
+
+// Time to parse and free a large array of log records with the default
+// allocator (json) and with a monotonic_arena (arena_json). Two documents are
+// used: short messages, which fit the small-string buffer and are entirely in
+// the arena, and long messages, whose characters still come from the heap.
+
+#include "json.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+using nlohmann::json;
+using nlohmann::arena_json;
+
+namespace
+{
+
+std::string log_array(const std::size_t message_length)
+{
+    json logs = json::array();
+    for (int i = 0; i < 100000; ++i)
+    {
+        logs.push_back(
+        {
+            {"id", i}, {"ts", 1700000000 + i}, {"lvl", i % 5},
+            {"msg", std::string(message_length, static_cast<char>('a' + i % 26))},
+            {"tags", {i % 7, i % 11}}
+        });
+    }
+    return logs.dump();
+}
+
+using clock_type = std::chrono::steady_clock;
+
+double milliseconds(const clock_type::time_point start, const clock_type::time_point stop)
+{
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+void print(const char* name, const std::size_t bytes, const double parse_ms, const double free_ms)
+{
+    std::printf("  %-24s parse %8.2f ms %8.1f MB/s   free %8.2f ms\n",
+                name, parse_ms, static_cast<double>(bytes) / 1e3 / parse_ms, free_ms);
+}
+
+void run(const char* document, const std::string& text)
+{
+    std::printf("%s (%zu bytes)\n", document, text.size());
+
+    double parse_ms = 1e300;
+    double free_ms = 1e300;
+    for (int i = 0; i < 5; ++i)
+    {
+        const auto start = clock_type::now();
+        auto j = std::unique_ptr<json>(new json(json::parse(text)));
+        const auto parsed = clock_type::now();
+        j.reset();
+        const auto freed = clock_type::now();
+        parse_ms = (std::min)(parse_ms, milliseconds(start, parsed));
+        free_ms = (std::min)(free_ms, milliseconds(parsed, freed));
+    }
+    print("json", text.size(), parse_ms, free_ms);
+
+    parse_ms = 1e300;
+    free_ms = 1e300;
+    for (int i = 0; i < 5; ++i)
+    {
+        nlohmann::monotonic_arena arena(1024 * 1024);
+        const auto start = clock_type::now();
+        clock_type::time_point parsed;
+        {
+            const nlohmann::arena_scope scope(arena);
+            auto j = std::unique_ptr<arena_json>(new arena_json(arena_json::parse(text)));
+            parsed = clock_type::now();
+            // destroying still walks the tree and frees long strings
+            j.reset();
+        }
+        arena.release();
+        const auto freed = clock_type::now();
+        parse_ms = (std::min)(parse_ms, milliseconds(start, parsed));
+        free_ms = (std::min)(free_ms, milliseconds(parsed, freed));
+    }
+    print("arena_json", text.size(), parse_ms, free_ms);
+}
+
+}  // namespace
+
+int main()
+{
+    run("short messages", log_array(8));
+    run("long messages", log_array(80));
+}
@@ -0,0 +1,84 @@
+//     __ _____ _____ _____
+//  __|  |   __|     |   | |  JSON for Modern C++ (supporting code)
+// |  |  |__   |  |  | | | |  version 3.11.3
+// |_____|_____|_____|_|___|  https://github.com/nlohmann/json
+//
+// SPDX-FileCopyrightText: 2013 - 2025 Niels Lohmann <https://nlohmann.me>
+// SPDX-License-Identifier: MIT
+
+// Throughput of dump() for arrays of doubles (uniform values and random bit
+// patterns), of integers of all lengths, and of a mixed document, next to
+// std::snprintf("%.17g") over the same doubles.
+
+#include "json.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+
+#include "bench.hpp"
+
+using nlohmann::json;
+
+namespace
+{
+
+void report_dump(const char* name, const json& value)
+{
+    const std::size_t bytes = value.dump().size();
+    json_bench::report(name, bytes, [&value]()
+    {
+        return value.dump().size();
+    });
+}
+
+}  // namespace
+
+int main()
+{
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> uniform(-1000.0, 1000.0);
+
+    json uniform_doubles = json::array();
+    json random_doubles = json::array();
+    json integers = json::array();
+    json records = json::array();
+    for (int i = 0; i < 1000000; ++i)
+    {
+        uniform_doubles.push_back(uniform(rng));
+
+        double value = 0;
+        do
+        {
+            const std::uint64_t bits = rng();
+            std::memcpy(&value, &bits, sizeof(value));
+        }
+        while (!std::isfinite(value));
+        random_doubles.push_back(value);
+
+        integers.push_back(rng() >> (rng() % 64));
+    }
+    for (int i = 0; i < 200000; ++i)
+    {
+        records.push_back({{"id", i}, {"name", "record " + std::to_string(i)}, {"value", uniform(rng)}, {"active", i % 2 == 0}});
+    }
+
+    report_dump("dump 1M uniform doubles", uniform_doubles);
+    report_dump("dump 1M random doubles", random_doubles);
+    report_dump("dump 1M integers", integers);
+    report_dump("dump 200k records", records);
+
+    json_bench::report("snprintf %.17g over 1M random doubles", 0, [&random_doubles]()
+    {
+        char buffer[32];
+        std::size_t size = 0;
+        for (const auto& value : random_doubles)
+        {
+            size += static_cast<std::size_t>(std::snprintf(buffer, sizeof(buffer), "%.17g", value.get<double>()));
+        }
+        return size;
+    });
+}
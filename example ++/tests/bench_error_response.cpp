@@ -0,0 +1,110 @@
+//     __ _____ _____ _____
+//  __|  |   __|     |   | |  JSON for Modern C++ (supporting code)
+// |  |  |__   |  |  | | | |  version 3.11.3
+// |_____|_____|_____|_|___|  https://github.com/nlohmann/json
+//
+// SPDX-FileCopyrightText: 2013 - 2025 Niels Lohmann <https://nlohmann.me>
+// SPDX-License-Identifier: MIT
+
+// Cost of the failure path of a client that reads a few fields of a reply,
+// when the reply is an HTML error page from a proxy instead of JSON: parse
+// without exceptions and guarded value() calls, next to try_parse and a check
+// for the discarded value. The success path is shown for comparison.
+
+#include "json.hpp"
+
+#include <string>
+
+#include "bench.hpp"
+
+using nlohmann::json;
+
+namespace
+{
+
+const char* const error_page =
+    "<html>\r\n<head><title>502 Bad Gateway</title></head>\r\n<body>\r\n"
+    "<center><h1>502 Bad Gateway</h1></center>\r\n<hr><center>nginx</center>\r\n"
+    "</body>\r\n</html>\r\n";
+
+const char* const success_reply =
+    R"({"success": true, "message": "ok", "version": "1.4.2", "app_name": "client", "update_required": false})";
+
+const int replies = 100000;
+
+// reading fields as before try_parse: every lookup on the discarded value throws
+std::size_t read_with_exceptions(const std::string& reply)
+{
+    const json r = json::parse(reply, nullptr, false);
+    std::size_t count = 0;
+    for (const char* key : {"success", "update_required"})
+    {
+        try
+        {
+            count += r.value(key, false) ? 1 : 0;
+        }
+        catch (const json::type_error&)
+        {
+            ++count;
+        }
+    }
+    return count;
+}
+
+// reading fields as api.hpp does: defaults for a reply that is not JSON
+std::size_t read_with_try_parse(const std::string& reply)
+{
+    json r;
+    json::try_parse(reply, r);
+    std::size_t count = 0;
+    for (const char* key : {"success", "update_required"})
+    {
+        count += (r.is_discarded() ? false : r.value(key, false)) ? 1 : 0;
+    }
+    return count;
+}
+
+}  // namespace
+
+int main()
+{
+    const std::string page = error_page;
+    const std::string reply = success_reply;
+
+    json_bench::report("error page: parse + value() with try/catch", page.size() * replies, [&]()
+    {
+        std::size_t count = 0;
+        for (int i = 0; i < replies; ++i)
+        {
+            count += read_with_exceptions(page);
+        }
+        return count;
+    });
+    json_bench::report("error page: try_parse + is_discarded", page.size() * replies, [&]()
+    {
+        std::size_t count = 0;
+        for (int i = 0; i < replies; ++i)
+        {
+            count += read_with_try_parse(page);
+        }
+        return count;
+    });
+    json_bench::report("JSON reply: parse + value()", reply.size() * replies, [&]()
+    {
+        std::size_t count = 0;
+        for (int i = 0; i < replies; ++i)
+        {
+            count += read_with_exceptions(reply);
+        }
+        return count;
+    });
+    json_bench::report("JSON reply: try_parse + value()", reply.size() * replies, [&]()
+    {
+        std::size_t count = 0;
+        for (int i = 0; i < replies; ++i)
+        {
+            count += read_with_try_parse(reply);
+        }
+        return count;
+    });
+}
@@ -0,0 +1,109 @@
+//     __ _____ _____ _____
+//  __|  |   __|     |   | |  JSON for Modern C++ (supporting code)
+// |  |  |__   |  |  | | | |  version 3.11.3
+// |_____|_____|_____|_|___|  https://github.com/nlohmann/json
+//
+// SPDX-FileCopyrightText: 2013 - 2025 Niels Lohmann <https://nlohmann.me>
+// SPDX-License-Identifier: MIT
+
+// json (std::map) next to flat_json (flat_map) for objects of 8 and 32
+// members: building them by parsing, looking up every member, iterating, and
+// destroying.
+
+#include "json.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+
+using nlohmann::json;
+using nlohmann::flat_json;
+
+namespace
+{
+
+template<typename Json>
+void run(const char* name, const std::string& text, const std::vector<std::string>& keys)
+{
+    std::printf("%s\n", name);
+    json_bench::report("  build (parse)", text.size(), [&]()
+    {
+        return Json::parse(text).size();
+    });
+
+    const Json doc = Json::parse(text);
+    json_bench::report("  lookup of every member", 0, [&]()
+    {
+        std::size_t sum = 0;
+        for (const auto& object : doc)
+        {
+            for (const auto& key : keys)
+            {
+                sum += object.find(key)->template get<std::size_t>();
+            }
+        }
+        return sum;
+    });
+    json_bench::report("  iteration", 0, [&]()
+    {
+        std::size_t sum = 0;
+        for (const auto& object : doc)
+        {
+            for (const auto& member : object.items())
+            {
+                sum += member.key().size() + member.value().template get<std::size_t>();
+            }
+        }
+        return sum;
+    });
+
+    // the copy is not timed
+    double best = 1e300;
+    for (int i = 0; i < 5; ++i)
+    {
+        std::unique_ptr<Json> copy(new Json(doc));
+        const auto start = std::chrono::steady_clock::now();
+        copy.reset();
+        const auto stop = std::chrono::steady_clock::now();
+        best = (std::min)(best, std::chrono::duration<double, std::milli>(stop - start).count());
+    }
+    std::printf("%-48s %10.2f ms\n", "  destruction", best);
+}
+
+void run(const std::size_t members)
+{
+    std::vector<std::string> keys;
+    for (std::size_t i = 0; i < members; ++i)
+    {
+        // not in sorted order, as in real documents
+        keys.push_back("field_" + std::to_string((i * 7) % members));
+    }
+    std::string text = "[";
+    for (std::size_t n = 0; n < 200000 / members; ++n)
+    {
+        text += n != 0 ? ",{" : "{";
+        for (std::size_t i = 0; i < members; ++i)
+        {
+            text += (i != 0 ? ",\"" : "\"") + keys[i] + "\":" + std::to_string(n + i);
+        }
+        text += "}";
+    }
+    text += "]";
+
+    std::printf("--- %zu members per object, %zu bytes\n", members, text.size());
+    run<json>("json", text, keys);
+    run<flat_json>("flat_json", text, keys);
+}
+
+}  // namespace
+
+int main()
+{
+    run(8);
+    run(32);
+}
@@ -0,0 +1,71 @@
+//     __ _____ _____ _____
+//  __|  |   __|     |   | |  JSON for Modern C++ (supporting code)
+// |  |  |__   |  |  | | | |  version 3.11.3
+// |_____|_____|_____|_|___|  https://github.com/nlohmann/json
+//
+// SPDX-FileCopyrightText: 2013 - 2025 Niels Lohmann <https://nlohmann.me>
+// SPDX-License-Identifier: MIT
+
+// Scaling of ndjson_reader with the number of threads on about 25 MB of log
+// records, next to reading the lines with std::getline and parsing them one
+// by one. Pass the largest thread count to try as the first argument; the
+// default is the number of hardware threads, but at least 4.
+
+#include "json.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "bench.hpp"
+
+using nlohmann::json;
+using nlohmann::ndjson_options;
+using nlohmann::ndjson_reader;
+
+int main(int argc, char** argv)
+{
+    std::string text;
+    for (int i = 0; text.size() < 25 * 1000 * 1000; ++i)
+    {
+        text += json({{"timestamp", 1700000000000 + i}, {"level", i % 7 == 0 ? "warning" : "info"},
+            {"message", "request " + std::to_string(i) + " served"}, {"latency", i * 0.013}, {"tags", {"api", "v2"}}
+        }).dump();
+        text += '\n';
+    }
+
+    const unsigned hardware_threads = std::thread::hardware_concurrency();
+    const std::size_t max_threads = argc > 1 ? static_cast<std::size_t>(std::atoi(argv[1])) : (std::max)(4u, hardware_threads);
+    std::printf("%u hardware thread(s)\n", hardware_threads);
+
+    json_bench::report("getline + parse", text.size(), [&text]()
+    {
+        std::istringstream stream(text);
+        std::string line;
+        std::size_t count = 0;
+        while (std::getline(stream, line))
+        {
+            count += json::parse(line).size();
+        }
+        return count;
+    });
+
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        const std::string name = "ndjson_reader, " + std::to_string(threads) + " thread(s)";
+        json_bench::report(name.c_str(), text.size(), [&text, threads]()
+        {
+            ndjson_options options;
+            options.threads = threads;
+            ndjson_reader reader(text, options);
+            std::size_t count = 0;
+            reader.for_each([&count](json && record)
+            {
+                count += record.size();
+            });
+            return count;
+        });
+    }
+}
@@ -0,0 +1,58 @@
+//     __ _____ _____ _____
+//  __|  |   __|     |   | |  JSON for Modern C++ (supporting code)
+// |  |  |__   |  |  | | | |  version 3.11.3
+// |_____|_____|_____|_|___|  https://github.com/nlohmann/json
+//
+// SPDX-FileCopyrightText: 2013 - 2025 Niels Lohmann <https://nlohmann.me>
+// SPDX-License-Identifier: MIT
+
+// Throughput of parsing a numeric-heavy document (a telemetry series of
+// [timestamp, double, double, counter] samples), next to a std::strtod loop
+// over the same literals.
+
+#include "json.hpp"
+
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+
+using nlohmann::json;
+
+int main()
+{
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> value(-1000.0, 1000.0);
+
+    json series = json::array();
+    for (int i = 0; i < 200000; ++i)
+    {
+        series.push_back({1700000000000 + i * 250, value(rng), value(rng) * 1e6, rng() % 100000});
+    }
+    const std::string text = series.dump();
+
+    std::vector<std::string> literals;
+    for (const auto& sample : series)
+    {
+        for (const auto& field : sample)
+        {
+            literals.push_back(field.dump());
+        }
+    }
+
+    json_bench::report("json::parse", text.size(), [&]()
+    {
+        return json::parse(text).size();
+    });
+    json_bench::report("strtod over the literals", text.size(), [&]()
+    {
+        double sum = 0;
+        for (const auto& literal : literals)
+        {
+            sum += std::strtod(literal.c_str(), nullptr);
+        }
+        return static_cast<std::size_t>(sum != 0);
+    });
+}
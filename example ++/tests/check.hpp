@@ -0,0 +1,48 @@
+//     __ _____ _____ _____
+//  __|  |   __|     |   | |  JSON for Modern C++ (supporting code)
+// |  |  |__   |  |  | | | |  version 3.11.3
+// |_____|_____|_____|_|___|  https://github.com/nlohmann/json
+//
+// SPDX-FileCopyrightText: 2013 - 2025 Niels Lohmann <https://nlohmann.me>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE
+#include <iostream> // cerr, cout
+
+// Minimal checking for the tests in this directory: CHECK reports a failed
+// condition and continues, and test_result() turns the failure count into the
+// exit status that ctest expects.
+
+namespace json_test
+{
+
+inline int& failures()
+{
+    static int count = 0;
+    return count;
+}
+
+inline int test_result(const char* name)
+{
+    if (failures() != 0)
+    {
+        std::cerr << name << ": " << failures() << " check(s) failed\n";
+        return EXIT_FAILURE;
+    }
+    std::cout << name << ": passed\n";
+    return EXIT_SUCCESS;
+}
+
+}  // namespace json_test
+
+#define CHECK(condition)                                                             \
+    do                                                                               \
+    {                                                                                \
+        if (!(condition))                                                            \
+        {                                                                            \
+            ++json_test::failures();                                                 \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK(" #condition ") failed\n"; \
+        }                                                                            \
+    } while (false)
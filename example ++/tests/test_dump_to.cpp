@@ -0,0 +1,104 @@
+//     __ _____ _____ _____
+//  __|  |   __|     |   | |  JSON for Modern C++ (supporting code)
+// |  |  |__   |  |  | | | |  version 3.11.3
+// |_____|_____|_____|_|___|  https://github.com/nlohmann/json
+//
+// SPDX-FileCopyrightText: 2013 - 2025 Niels Lohmann <https://nlohmann.me>
+// SPDX-License-Identifier: MIT
+
+// dump_to must write the same characters as dump, to a function, a FILE*, and
+// a file descriptor, and an exception must leave only a prefix of them.
+
+#include "json.hpp"
+
+#include <cstdio>
+#include <string>
+
+#include "check.hpp"
+
+using nlohmann::json;
+
+namespace
+{
+
+json large_value()
+{
+    json j = json::array();
+    for (int i = 0; i < 5000; ++i)
+    {
+        j.push_back({{"index", i}, {"text", "\xC3\xA9 some text to fill the buffer"}});
+    }
+    return j;
+}
+
+std::string read_all(std::FILE* f)
+{
+    std::string text;
+    std::rewind(f);
+    for (int c = std::fgetc(f); c != EOF; c = std::fgetc(f))
+    {
+        text += static_cast<char>(c);
+    }
+    return text;
+}
+
+void test_outputs()
+{
+    const json j = large_value();
+
+    std::string text;
+    j.dump_to([&text](const char* s, std::size_t length)
+    {
+        text.append(s, length);
+    }, 2, ' ', true);
+    CHECK(text == j.dump(2, ' ', true));
+
+    std::FILE* f = std::tmpfile();
+    CHECK(f != nullptr);
+    j.dump_to(f);
+    CHECK(read_all(f) == j.dump());
+    std::fclose(f);
+
+#if JSON_HAS_FILE_DESCRIPTOR_OUTPUT
+    f = std::tmpfile();
+    CHECK(f != nullptr);
+    j.dump_to_fd(fileno(f));
+    CHECK(read_all(f) == j.dump());
+    std::fclose(f);
+#endif
+}
+
+void test_partial_output()
+{
+    // invalid UTF-8 after more than one buffer of output
+    json j = large_value();
+    j.push_back("\xFF");
+    const std::string valid_prefix = j.dump(-1, ' ', false, json::error_handler_t::replace);
+
+    std::string text;
+    bool thrown = false;
+    try
+    {
+        j.dump_to([&text](const char* s, std::size_t length)
+        {
+            text.append(s, length);
+        });
+    }
+    catch (const json::type_error& e)
+    {
+        thrown = e.id == 316;
+    }
+    CHECK(thrown);
+    CHECK(!text.empty());
+    CHECK(text.size() < valid_prefix.size());
+    CHECK(valid_prefix.compare(0, text.size(), text) == 0);
+}
+
+}  // namespace
+
+int main()
+{
+    test_outputs();
+    test_partial_output();
+    return json_test::test_result("test_dump_to");
+}
@@ -0,0 +1,146 @@
+//     __ _____ _____ _____
+//  __|  |   __|     |   | |  JSON for Modern C++ (supporting code)
+// |  |  |__   |  |  | | | |  version 3.11.3
+// |_____|_____|_____|_|___|  https://github.com/nlohmann/json
+//
+// SPDX-FileCopyrightText: 2013 - 2025 Niels Lohmann <https://nlohmann.me>
+// SPDX-License-Identifier: MIT
+
+// file_input_adapter must leave a FILE* right after the parsed value, whether
+// it reads ahead (seekable files) or not (pipes).
+
+#include "json.hpp"
+
+#include <cstdio>
+#include <string>
+
+#include "check.hpp"
+
+using nlohmann::json;
+
+namespace
+{
+
+// a SAX handler that accepts everything
+struct null_sax : nlohmann::json_sax<json>
+{
+    bool null() override
+    {
+        return true;
+    }
+    bool boolean(bool /*unused*/) override
+    {
+        return true;
+    }
+    bool number_integer(number_integer_t /*unused*/) override
+    {
+        return true;
+    }
+    bool number_unsigned(number_unsigned_t /*unused*/) override
+    {
+        return true;
+    }
+    bool number_float(number_float_t /*unused*/, const string_t& /*unused*/) override
+    {
+        return true;
+    }
+    bool string(string_t& /*unused*/) override
+    {
+        return true;
+    }
+    bool binary(binary_t& /*unused*/) override
+    {
+        return true;
+    }
+    bool start_object(std::size_t /*unused*/) override
+    {
+        return true;
+    }
+    bool key(string_t& /*unused*/) override
+    {
+        return true;
+    }
+    bool end_object() override
+    {
+        return true;
+    }
+    bool start_array(std::size_t /*unused*/) override
+    {
+        return true;
+    }
+    bool end_array() override
+    {
+        return true;
+    }
+    bool parse_error(std::size_t /*unused*/, const std::string& /*unused*/, const nlohmann::detail::exception& /*unused*/) override
+    {
+        return false;
+    }
+};
+
+std::string rest_of(std::FILE* f)
+{
+    std::string rest;
+    for (int c = std::fgetc(f); c != EOF; c = std::fgetc(f))
+    {
+        rest += static_cast<char>(c);
+    }
+    return rest;
+}
+
+// a long first value, so that several blocks are read
+std::string first_value()
+{
+    json j = json::array();
+    for (int i = 0; i < 5000; ++i)
+    {
+        j.push_back({{"index", i}, {"text", "some text to fill the block"}});
+    }
+    return j.dump();
+}
+
+void test_seekable()
+{
+    const std::string first = first_value();
+    std::FILE* f = std::tmpfile();
+    CHECK(f != nullptr);
+    std::fputs((first + "{\"second\":true}\n").c_str(), f);
+    std::rewind(f);
+
+    null_sax sax;
+    CHECK(json::sax_parse(f, &sax, nlohmann::detail::input_format_t::json, false));
+    CHECK(std::ftell(f) == static_cast<long>(first.size()));
+    CHECK(json::parse(rest_of(f)) == json({{"second", true}}));
+    std::fclose(f);
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+void test_pipe()
+{
+    const std::string first = first_value();
+    const std::string path = "test_file_input.tmp";
+    std::FILE* out = std::fopen(path.c_str(), "wb");
+    CHECK(out != nullptr);
+    std::fputs((first + "{\"second\":true}\n").c_str(), out);
+    std::fclose(out);
+
+    std::FILE* f = popen(("cat " + path).c_str(), "r");
+    CHECK(f != nullptr);
+    null_sax sax;
+    CHECK(json::sax_parse(f, &sax, nlohmann::detail::input_format_t::json, false));
+    CHECK(json::parse(rest_of(f)) == json({{"second", true}}));
+    pclose(f);
+    std::remove(path.c_str());
+}
+#endif
+
+}  // namespace
+
+int main()
+{
+    test_seekable();
+#if defined(__unix__) || defined(__APPLE__)
+    test_pipe();
+#endif
+    return json_test::test_result("test_file_input");
+}
@@ -0,0 +1,158 @@
+//     __ _____ _____ _____
+//  __|  |   __|     |   | |  JSON for Modern C++ (supporting code)
+// |  |  |__   |  |  | | | |  version 3.11.3
+// |_____|_____|_____|_|___|  https://github.com/nlohmann/json
+//
+// SPDX-FileCopyrightText: 2013 - 2025 Niels Lohmann <https://nlohmann.me>
+// SPDX-License-Identifier: MIT
+
+// flat_map must behave like std::map under random inserts and erases, and a
+// key copy that throws while elements are shifted must leave it unchanged.
+
+#include "json.hpp"
+
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "check.hpp"
+
+using nlohmann::json;
+using nlohmann::flat_json;
+
+namespace
+{
+
+// a key whose copies throw once a global budget is used up
+struct fragile_key
+{
+    static int copies_left;
+
+    int value = 0;
+
+    explicit fragile_key(int v) : value(v) {}
+    fragile_key(const fragile_key& other) : value(other.value)
+    {
+        if (copies_left-- == 0)
+        {
+            throw std::runtime_error("copy failed");
+        }
+    }
+    fragile_key(fragile_key&& other) noexcept : value(other.value) {}
+    fragile_key& operator=(const fragile_key&) = delete;
+    fragile_key& operator=(fragile_key&&) = delete;
+    ~fragile_key() = default;
+
+    bool operator<(const fragile_key& other) const
+    {
+        return value < other.value;
+    }
+};
+
+int fragile_key::copies_left = -1;
+
+using fragile_map = nlohmann::flat_map<fragile_key, std::string>;
+
+std::map<int, std::string> contents(const fragile_map& m)
+{
+    std::map<int, std::string> result;
+    for (const auto& element : m)
+    {
+        result.emplace(element.first.value, element.second);
+    }
+    return result;
+}
+
+void test_against_map()
+{
+    std::mt19937 rng(7);
+    flat_json flat = flat_json::object();
+    json tree = json::object();
+    for (int i = 0; i < 20000; ++i)
+    {
+        const std::string key = "key" + std::to_string(rng() % 200);
+        if (rng() % 3 == 0)
+        {
+            CHECK(flat.erase(key) == tree.erase(key));
+        }
+        else
+        {
+            flat[key] = i;
+            tree[key] = i;
+        }
+    }
+    CHECK(flat.size() == tree.size());
+    CHECK(flat.dump() == tree.dump());
+    CHECK(flat_json::parse(tree.dump()).dump() == tree.dump());
+}
+
+void test_throwing_key_copies()
+{
+    for (int budget = 0; budget < 12; ++budget)
+    {
+        // insertions in front of existing elements, with and without growing the storage
+        for (const bool full : {false, true})
+        {
+            fragile_key::copies_left = -1;
+            fragile_map m;
+            m.reserve(full ? 8 : 64);
+            for (int k = 10; k < 90; k += 10)
+            {
+                m.emplace(fragile_key(k), std::to_string(k));
+            }
+            const auto before = contents(m);
+
+            fragile_key::copies_left = budget;
+            bool thrown = false;
+            try
+            {
+                m.emplace(fragile_key(5), "5");
+            }
+            catch (const std::runtime_error&)
+            {
+                thrown = true;
+            }
+            fragile_key::copies_left = -1;
+            if (thrown)
+            {
+                CHECK(contents(m) == before);
+            }
+            else
+            {
+                CHECK(m.size() == before.size() + 1 && m.begin()->first.value == 5);
+            }
+        }
+
+        // erasing in front of existing elements
+        fragile_key::copies_left = -1;
+        fragile_map m;
+        for (int k = 10; k < 90; k += 10)
+        {
+            m.emplace(fragile_key(k), std::to_string(k));
+        }
+        const auto before = contents(m);
+        fragile_key::copies_left = budget;
+        bool thrown = false;
+        try
+        {
+            m.erase(m.begin());
+        }
+        catch (const std::runtime_error&)
+        {
+            thrown = true;
+        }
+        fragile_key::copies_left = -1;
+        CHECK(thrown ? contents(m) == before : m.size() + 1 == before.size());
+    }
+}
+
+}  // namespace
+
+int main()
+{
+    test_against_map();
+    test_throwing_key_copies();
+    return json_test::test_result("test_flat_map");
+}
@@ -0,0 +1,187 @@
+//     __ _____ _____ _____
+//  __|  |   __|     |   | |  JSON for Modern C++ (supporting code)
+// |  |  |__   |  |  | | | |  version 3.11.3
+// |_____|_____|_____|_|___|  https://github.com/nlohmann/json
+//
+// SPDX-FileCopyrightText: 2013 - 2025 Niels Lohmann <https://nlohmann.me>
+// SPDX-License-Identifier: MIT
+
+// The serializer must write floating-point numbers with the shortest digits
+// that read back as the same value, and among those the closest ones.
+//
+// Doubles are checked at random bit patterns and edge cases against
+// std::strtod and std::snprintf. Floats are checked for every 1021st bit
+// pattern, or for all of them when run with --exhaustive (a few minutes in a
+// Release build; see JSON_EXHAUSTIVE_TESTS).
+
+#include "json.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "check.hpp"
+
+using nlohmann::json;
+using float_json = nlohmann::basic_json<std::map, std::vector, std::string, bool, std::int64_t, std::uint64_t, float>;
+
+namespace
+{
+
+// the significant digits of a number literal, without leading or trailing zeros
+std::string significant_digits(const std::string& literal)
+{
+    std::string digits;
+    for (const char c : literal.substr(0, literal.find_first_of("eE")))
+    {
+        if (c >= '0' && c <= '9' && !(digits.empty() && c == '0'))
+        {
+            digits += c;
+        }
+    }
+    return digits.substr(0, digits.find_last_not_of('0') + 1);
+}
+
+template<typename Float>
+Float read_back(const char* literal)
+{
+    return sizeof(Float) == sizeof(float) ? static_cast<Float>(std::strtof(literal, nullptr)) : static_cast<Float>(std::strtod(literal, nullptr));
+}
+
+// the closest decimal with @a precision significant digits that reads back as
+// @a value: the correctly rounded one, or a neighbour where that falls just
+// outside the values that read back (as next to powers of two); empty if none
+template<typename Float>
+std::string closest_digits(const Float value, const int precision)
+{
+    char buffer[64];
+    std::snprintf(buffer, sizeof(buffer), "%.*e", precision - 1, static_cast<double>(value));
+
+    // the digits as an integer, and the power of ten they are scaled by
+    const char* const exponent = std::strchr(buffer, 'e');
+    long long digits = 0;
+    for (const char* c = buffer; c != exponent; ++c)
+    {
+        digits = (*c >= '0' && *c <= '9') ? digits * 10 + (*c - '0') : digits;
+    }
+    const int scale = std::atoi(exponent + 1) - precision + 1;
+
+    for (const long long candidate : {digits, digits - 1, digits + 1})
+    {
+        const std::string literal = std::to_string(candidate) + "e" + std::to_string(scale);
+        if (read_back<Float>(literal.c_str()) == std::fabs(value))
+        {
+            return literal;
+        }
+    }
+    return "";
+}
+
+// whether @a text reads back as @a value with the shortest and closest digits;
+// if fewer digits read back, so do one digit fewer (padded with zeros)
+template<typename Float>
+bool is_shortest_closest(const std::string& text, const Float value)
+{
+    const Float read = read_back<Float>(text.c_str());
+    if (std::memcmp(&read, &value, sizeof(value)) != 0)
+    {
+        return false;
+    }
+    const std::string digits = significant_digits(text);
+    const auto precision = static_cast<int>(digits.size());
+    return value == 0 || (significant_digits(closest_digits(value, precision)) == digits && (precision == 1 || closest_digits(value, precision - 1).empty()));
+}
+
+void check_double(const double value)
+{
+    const std::string text = json(value).dump();
+    if (!is_shortest_closest(text, value))
+    {
+        std::cerr << "unexpected output " << text << "\n";
+        CHECK(false);
+    }
+}
+
+void test_reference()
+{
+    // the check itself rejects longer or farther digits
+    CHECK(is_shortest_closest("0.1", 0.1));
+    CHECK(!is_shortest_closest("0.10000000000000001", 0.1));
+    CHECK(is_shortest_closest("6.272924515652406e+16", 6.272924515652406e+16));
+    CHECK(!is_shortest_closest("6.2729245156524064e+16", 6.272924515652406e+16));
+    CHECK(is_shortest_closest("5.960464477539063e-08", std::ldexp(1.0, -24)));
+    CHECK(!is_shortest_closest("5.960464477539062e-08", std::ldexp(1.0, -24)));
+    CHECK(!is_shortest_closest("0.30000001", 0.3f));
+}
+
+void test_doubles()
+{
+    static const double edge_cases[] =
+    {
+        0.0, -0.0, 1.0, 0.1, 0.3, 1e23, 5e-324, 1e-323, 2.2250738585072009e-308, 2.2250738585072014e-308,
+        1.7976931348623157e308, 9007199254740992.0, 9007199254740993.0, 1e15, 1e16, 1e17, 123456789012345678.0,
+        6.272924515652406e+16, 0.000001, 1e-7, 2.0 / 3.0,
+    };
+    for (const double value : edge_cases)
+    {
+        check_double(value);
+        check_double(-value);
+    }
+
+    // every power of two, where the interval of values reading back is asymmetric
+    for (int exponent = -1074; exponent <= 1023; ++exponent)
+    {
+        check_double(std::ldexp(1.0, exponent));
+    }
+
+    std::mt19937_64 rng(72);
+    for (int i = 0; i < 200000; ++i)
+    {
+        const std::uint64_t bits = rng();
+        double value = 0;
+        std::memcpy(&value, &bits, sizeof(value));
+        if (std::isfinite(value))
+        {
+            check_double(value);
+        }
+    }
+}
+
+void test_floats(const std::uint32_t stride)
+{
+    std::size_t failures = 0;
+    // all positive finite bit patterns; the sign is written separately
+    for (std::uint64_t bits = 1; bits < 0x7F800000u; bits += stride)
+    {
+        const auto pattern = static_cast<std::uint32_t>(bits);
+        float value = 0;
+        std::memcpy(&value, &pattern, sizeof(value));
+
+        const std::string text = float_json(value).dump();
+        if (!is_shortest_closest(text, value))
+        {
+            if (++failures <= 10)
+            {
+                std::cerr << "unexpected output " << text << " for float bits " << pattern << "\n";
+            }
+        }
+    }
+    CHECK(failures == 0);
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    const bool exhaustive = argc > 1 && std::strcmp(argv[1], "--exhaustive") == 0;
+    test_reference();
+    test_doubles();
+    test_floats(exhaustive ? 1 : 1021);
+    return json_test::test_result("test_float_roundtrip");
+}
@@ -0,0 +1,53 @@
+//     __ _____ _____ _____
+//  __|  |   __|     |   | |  JSON for Modern C++ (supporting code)
+// |  |  |__   |  |  | | | |  version 3.11.3
+// |_____|_____|_____|_|___|  https://github.com/nlohmann/json
+//
+// SPDX-FileCopyrightText: 2013 - 2025 Niels Lohmann <https://nlohmann.me>
+// SPDX-License-Identifier: MIT
+
+// lazy_number_json must keep short literals as text, read like json, and
+// convert to and from json.
+
+#include "json.hpp"
+
+#include <string>
+
+#include "check.hpp"
+
+using nlohmann::json;
+using nlohmann::lazy_number;
+using nlohmann::lazy_number_json;
+
+int main()
+{
+    const char* const text = R"([1.50,-122.4194155,0.1234567890,0.12345678901,1e-3,2.5E2,-0.0])";
+    const lazy_number_json lazy = lazy_number_json::parse(text);
+    const json plain = json::parse(text);
+
+    // literals of at most 12 characters without an exponent are written as parsed
+    CHECK(lazy.dump() == R"([1.50,-122.4194155,0.1234567890,0.12345678901,0.001,250.0,-0.0])");
+    CHECK(lazy[0].get_ref<const lazy_number&>().has_lexeme());
+    CHECK(lazy[2].get_ref<const lazy_number&>().has_lexeme());
+    CHECK(!lazy[3].get_ref<const lazy_number&>().has_lexeme());
+    CHECK(!lazy[4].get_ref<const lazy_number&>().has_lexeme());
+
+    // values read like those of json
+    for (std::size_t i = 0; i < plain.size(); ++i)
+    {
+        CHECK(lazy[i].get<double>() == plain[i].get<double>());
+    }
+    CHECK(lazy[0] == 1.5);
+
+    // conversions between the two types
+    const json converted = lazy;
+    CHECK(converted == plain);
+    const json single = lazy_number_json(1.5);
+    CHECK(single.is_number_float() && single.get<double>() == 1.5);
+    const json from_number = lazy_number(2.25);
+    CHECK(from_number.get<double>() == 2.25);
+    const lazy_number_json back = plain;
+    CHECK(back.dump() == plain.dump());
+
+    return json_test::test_result("test_lazy_number");
+}
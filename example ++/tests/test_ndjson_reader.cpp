@@ -0,0 +1,140 @@
+//     __ _____ _____ _____
+//  __|  |   __|     |   | |  JSON for Modern C++ (supporting code)
+// |  |  |__   |  |  | | | |  version 3.11.3
+// |_____|_____|_____|_|___|  https://github.com/nlohmann/json
+//
+// SPDX-FileCopyrightText: 2013 - 2025 Niels Lohmann <https://nlohmann.me>
+// SPDX-License-Identifier: MIT
+
+// ndjson_reader must deliver the records of a sequential parse of the lines,
+// with any number of threads and any chunk size, in order or not, and stop at
+// the first bad line.
+
+#include "json.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "check.hpp"
+
+using nlohmann::json;
+using nlohmann::ndjson_options;
+using nlohmann::ndjson_reader;
+
+namespace
+{
+
+std::string make_input(std::vector<json>& records)
+{
+    std::string text;
+    for (int i = 0; i < 3000; ++i)
+    {
+        records.push_back({{"i", i}, {"text", std::string(static_cast<std::size_t>(i % 97), 'x')}, {"values", {i, i * 0.5, nullptr}}});
+        text += records.back().dump();
+        // blank lines and carriage returns are skipped
+        text += (i % 10 == 0) ? "\r\n \t\n\n" : "\n";
+    }
+    return text;
+}
+
+std::vector<json> read_all(const std::string& text, const ndjson_options& options)
+{
+    std::vector<json> result;
+    ndjson_reader reader(text, options);
+    reader.for_each([&result](json && record)
+    {
+        result.push_back(std::move(record));
+    });
+    return result;
+}
+
+void test_records()
+{
+    std::vector<json> expected;
+    const std::string text = make_input(expected);
+
+    for (const std::size_t threads : {1, 2, 4})
+    {
+        for (const std::size_t chunk_size : {1, 100, 4096, 1 << 20})
+        {
+            ndjson_options options;
+            options.threads = threads;
+            options.chunk_size = chunk_size;
+            CHECK(read_all(text, options) == expected);
+
+            // unordered, the same records arrive in some order
+            options.ordered = false;
+            std::vector<json> unordered = read_all(text, options);
+            std::sort(unordered.begin(), unordered.end());
+            std::vector<json> sorted = expected;
+            std::sort(sorted.begin(), sorted.end());
+            CHECK(unordered == sorted);
+        }
+    }
+
+    // no input, and no trailing newline
+    CHECK(read_all("", ndjson_options()).empty());
+    const std::vector<json> last_line = read_all("1\n[2]", ndjson_options());
+    CHECK(last_line.size() == 2 && last_line[1] == json::parse("[2]"));
+}
+
+void test_errors()
+{
+    std::vector<json> records;
+    std::string text = make_input(records);
+    const std::size_t bad_line = 1234;
+    const std::size_t offset = text.find(records[bad_line].dump());
+    text.insert(offset, "{]\n");
+
+    for (const std::size_t threads : {1, 3})
+    {
+        ndjson_options options;
+        options.threads = threads;
+        options.chunk_size = 512;
+
+        // the records before the bad line are delivered, then its error is thrown
+        ndjson_reader reader(text, options);
+        json record;
+        std::size_t count = 0;
+        bool thrown = false;
+        try
+        {
+            while (reader.next(record))
+            {
+                CHECK(record == records[count]);
+                ++count;
+            }
+        }
+        catch (const json::parse_error& e)
+        {
+            thrown = e.id == 101;
+        }
+        CHECK(thrown);
+        CHECK(count == bad_line);
+        CHECK(!reader.next(record));
+
+        // without exceptions, the bad line is a discarded value
+        options.allow_exceptions = false;
+        const std::vector<json> lenient = read_all(text, options);
+        CHECK(lenient.size() == records.size() + 1);
+        CHECK(lenient[bad_line].is_discarded());
+    }
+
+    // a reader destroyed before reading everything stops its threads
+    ndjson_options options;
+    options.threads = 4;
+    options.chunk_size = 64;
+    ndjson_reader reader(text, options);
+    json record;
+    CHECK(reader.next(record));
+}
+
+}  // namespace
+
+int main()
+{
+    test_records();
+    test_errors();
+    return json_test::test_result("test_ndjson_reader");
+}
@@ -0,0 +1,183 @@
+//     __ _____ _____ _____
+//  __|  |   __|     |   | |  JSON for Modern C++ (supporting code)
+// |  |  |__   |  |  | | | |  version 3.11.3
+// |_____|_____|_____|_|___|  https://github.com/nlohmann/json
+//
+// SPDX-FileCopyrightText: 2013 - 2025 Niels Lohmann <https://nlohmann.me>
+// SPDX-License-Identifier: MIT
+
+// Differential fuzz test of the lexer's number conversion against
+// std::strtoull, std::strtoll, and std::strtod in the "C" locale.
+
+#include "json.hpp"
+
+#include <cerrno>
+#include <clocale>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+
+#include "check.hpp"
+
+using nlohmann::json;
+
+namespace
+{
+
+// a number literal as the JSON grammar allows it, biased towards hard cases
+std::string random_literal(std::mt19937_64& rng)
+{
+    static const char* const edge_cases[] =
+    {
+        "0", "-0", "0.0", "-0.0", "1", "-1", "0.1", "0.3", "1e23", "8.98846567431158e307", "1.7976931348623157e308",
+        "1.7976931348623158e308", "2.2250738585072011e-308", "2.2250738585072014e-308", "4.9406564584124654e-324",
+        "2.4703282292062327e-324", "2.4703282292062328e-324", "9007199254740993", "9007199254740992.5",
+        "18446744073709551615", "18446744073709551616", "9223372036854775807", "9223372036854775808",
+        "-9223372036854775808", "-9223372036854775809", "1e400", "-1e400", "1e-400", "123456789012345678901234567890",
+        "0.000000000000000000000000000000000000000001", "7.2057594037927933e16", "1.00000000000000011102230246251565404236316680908203125",
+        "1.00000000000000011102230246251565404236316680908203124", "1.00000000000000011102230246251565404236316680908203126",
+        "3.0540412e5", "1448997445238699", "5e-324", "1E+2", "1e-0", "0e1000", "-0e-1000",
+    };
+
+    const auto digits = [&rng](std::size_t count)
+    {
+        std::string s;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            s += static_cast<char>('0' + rng() % 10);
+        }
+        return s;
+    };
+
+    switch (rng() % 6)
+    {
+        case 0:
+            return edge_cases[rng() % (sizeof(edge_cases) / sizeof(edge_cases[0]))];
+
+        case 1:
+        {
+            // the shortest representation of a random double, and its neighbours in the last digit
+            std::uint64_t bits = rng();
+            double d = 0;
+            std::memcpy(&d, &bits, sizeof(d));
+            if (!std::isfinite(d))
+            {
+                d = 1.5;
+            }
+            std::string s = json(d).dump();
+            const auto last_digit = s.find_last_of("0123456789", s.find_first_of("eE"));
+            if (rng() % 2 == 0 && last_digit != std::string::npos)
+            {
+                s[last_digit] = static_cast<char>('0' + rng() % 10);
+            }
+            return s;
+        }
+
+        case 2:
+            // plain integers of every length around the 64-bit limits
+            return (rng() % 2 ? "-" : "") + std::string(1, static_cast<char>('1' + rng() % 9)) + digits(rng() % 21);
+
+        default:
+        {
+            // many significant digits, long fractions, and exponents at the range limits
+            std::string s = (rng() % 2 ? "-" : "");
+            s += (rng() % 4 == 0) ? "0" : std::string(1, static_cast<char>('1' + rng() % 9)) + digits(rng() % 25);
+            if (rng() % 3 != 0)
+            {
+                s += "." + digits(1 + rng() % 30);
+            }
+            if (rng() % 2 == 0)
+            {
+                s += (rng() % 2) ? "e" : "E";
+                s += (rng() % 3 == 0) ? "" : ((rng() % 2) ? "-" : "+");
+                s += std::to_string(rng() % 340);
+            }
+            return s;
+        }
+    }
+}
+
+bool same_bits(const double a, const double b)
+{
+    return std::memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+void check_literal(const std::string& literal)
+{
+    const bool is_integer = literal.find_first_of(".eE") == std::string::npos;
+    const bool negative = literal[0] == '-';
+
+    // the same decisions as the lexer: integers that fit are integers, everything else is a double
+    errno = 0;
+    char* end = nullptr;
+    if (is_integer && !negative)
+    {
+        const auto expected = std::strtoull(literal.c_str(), &end, 10);
+        if (errno == 0)
+        {
+            const json j = json::parse(literal);
+            CHECK(j.is_number_unsigned() && j.get<std::uint64_t>() == expected);
+            return;
+        }
+    }
+    else if (is_integer)
+    {
+        const auto expected = std::strtoll(literal.c_str(), &end, 10);
+        if (errno == 0)
+        {
+            const json j = json::parse(literal);
+            CHECK(j.is_number_integer() && j.get<std::int64_t>() == expected);
+            return;
+        }
+    }
+
+    const double expected = std::strtod(literal.c_str(), &end);
+    if (!std::isfinite(expected))
+    {
+        bool thrown = false;
+        try
+        {
+            const json j = json::parse(literal);
+            static_cast<void>(j);
+        }
+        catch (const json::out_of_range& e)
+        {
+            thrown = e.id == 406;
+        }
+        CHECK(thrown);
+        return;
+    }
+
+    const json j = json::parse(literal);
+    CHECK(j.is_number_float());
+    if (!same_bits(j.get<double>(), expected))
+    {
+        std::cerr << "mismatch for " << literal << "\n";
+        CHECK(same_bits(j.get<double>(), expected));
+    }
+}
+
+}  // namespace
+
+int main()
+{
+    std::mt19937_64 rng(5489);
+    for (int i = 0; i < 300000; ++i)
+    {
+        check_literal(random_literal(rng));
+    }
+
+    // the conversion must not depend on the global locale
+    if (std::setlocale(LC_NUMERIC, "de_DE.UTF-8") != nullptr || std::setlocale(LC_NUMERIC, "de_DE") != nullptr)
+    {
+        const json j = json::parse("[0.5, 1.25e3]");
+        CHECK(j[0].get<double>() == 0.5);
+        CHECK(j[1].get<double>() == 1250.0);
+        std::setlocale(LC_NUMERIC, "C");
+    }
+
+    return json_test::test_result("test_number_parse");
+}
@@ -0,0 +1,139 @@
+//     __ _____ _____ _____
+//  __|  |   __|     |   | |  JSON for Modern C++ (supporting code)
+// |  |  |__   |  |  | | | |  version 3.11.3
+// |_____|_____|_____|_|___|  https://github.com/nlohmann/json
+//
+// SPDX-FileCopyrightText: 2013 - 2025 Niels Lohmann <https://nlohmann.me>
+// SPDX-License-Identifier: MIT
+
+// ondemand_json must read the same values as json, whether it refers to the
+// caller's characters or to a copy, and whether elements are visited with
+// iterators or with at().
+
+#include "json.hpp"
+
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "check.hpp"
+
+using nlohmann::json;
+using nlohmann::ondemand_json;
+
+namespace
+{
+
+// rebuild a DOM from an on-demand value by iterating it
+json rebuild(const ondemand_json& value)
+{
+    if (value.is_array())
+    {
+        json result = json::array();
+        for (const auto& element : value)
+        {
+            result.push_back(rebuild(element));
+        }
+        return result;
+    }
+    if (value.is_object())
+    {
+        json result = json::object();
+        for (auto it = value.begin(); it != value.end(); ++it)
+        {
+            // the first of duplicate keys wins, as in at()
+            result.emplace(it.key(), rebuild(it.value()));
+        }
+        return result;
+    }
+    return value.get<json>();
+}
+
+const char* const document = R"( {"logs": [ {"id": 1, "msg": "a\"b", "tags": []}, {"id": 2, "msg": "é", "tags": ["x", {}]} ],
+    "count" : 2, "empty": {}, "nested": [[1, [2, [3]]], null, true, -1.5e3], "key \\u0041": "escaped" } )";
+
+void test_inputs()
+{
+    const json expected = json::parse(document);
+
+    // views of the caller's characters
+    const std::string text = document;
+    const std::vector<char> bytes(text.begin(), text.end());
+    CHECK(rebuild(ondemand_json::parse(document)) == expected);
+    CHECK(rebuild(ondemand_json::parse(text)) == expected);
+    CHECK(rebuild(ondemand_json::parse(bytes)) == expected);
+    CHECK(rebuild(ondemand_json::parse(text.begin(), text.end())) == expected);
+
+    // copies
+    const std::list<char> list(text.begin(), text.end());
+    std::istringstream stream(text);
+    CHECK(rebuild(ondemand_json::parse(std::string(document))) == expected);
+    CHECK(rebuild(ondemand_json::parse(list.begin(), list.end())) == expected);
+    CHECK(rebuild(ondemand_json::parse(stream)) == expected);
+
+    // values keep an owned document alive
+    const auto logs = ondemand_json::parse(std::string(document)).at("logs");
+    CHECK(logs.at(1).at("msg").get<std::string>() == "\xC3\xA9");
+}
+
+void test_iteration()
+{
+    json array = json::array();
+    for (int i = 0; i < 1000; ++i)
+    {
+        array.push_back({{"i", i}, {"s", std::to_string(i)}});
+    }
+    const std::string text = array.dump(1);
+    const auto doc = ondemand_json::parse(text);
+
+    std::size_t index = 0;
+    for (const auto& element : doc)
+    {
+        CHECK(element.at("i").get<std::size_t>() == index);
+        CHECK(element.at("i").get<std::size_t>() == doc.at(index).at("i").get<std::size_t>());
+        ++index;
+    }
+    CHECK(index == 1000);
+
+    // iterating an empty container or a scalar visits nothing
+    CHECK(doc.at(0).at("s").begin() == doc.at(0).at("s").end());
+    CHECK(ondemand_json::parse("[ ]").begin() == ondemand_json::parse("[ ]").end());
+
+    // array elements have no key
+    bool thrown = false;
+    try
+    {
+        static_cast<void>(doc.begin().key());
+    }
+    catch (const json::type_error& e)
+    {
+        thrown = e.id == 207;
+    }
+    CHECK(thrown);
+
+    // a missing comma between containers is found when iterating
+    const auto broken = ondemand_json::parse("[[1] [2]]");
+    thrown = false;
+    try
+    {
+        for (const auto& element : broken)
+        {
+            static_cast<void>(element);
+        }
+    }
+    catch (const json::parse_error&)
+    {
+        thrown = true;
+    }
+    CHECK(thrown);
+}
+
+}  // namespace
+
+int main()
+{
+    test_inputs();
+    test_iteration();
+    return json_test::test_result("test_ondemand");
+}
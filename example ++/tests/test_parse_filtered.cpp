@@ -0,0 +1,193 @@
+//     __ _____ _____ _____
+//  __|  |   __|     |   | |  JSON for Modern C++ (supporting code)
+// |  |  |__   |  |  | | | |  version 3.11.3
+// |_____|_____|_____|_|___|  https://github.com/nlohmann/json
+//
+// SPDX-FileCopyrightText: 2013 - 2025 Niels Lohmann <https://nlohmann.me>
+// SPDX-License-Identifier: MIT
+
+// parse_filtered must build the same value as parse with the same callback,
+// minus the discarded values that parse may leave in objects, and must report
+// the errors it promises to detect inside skipped values.
+
+#include "json.hpp"
+
+#include <random>
+#include <sstream>
+#include <string>
+
+#include "check.hpp"
+
+using nlohmann::json;
+
+namespace
+{
+
+json random_value(std::mt19937& rng, const int depth)
+{
+    static const char* const keys[] = {"a", "b", "x1", "x2", "gone", "id", "tags", "xs"};
+    switch (depth < 5 ? rng() % 8 : rng() % 4)
+    {
+        case 0:
+            return nullptr;
+        case 1:
+            return static_cast<int>(rng() % 10);
+        case 2:
+            return rng() % 2 == 0;
+        case 3:
+            return std::string(rng() % 4, 'x') + "\\\"]}";
+        case 4:
+        case 5:
+        {
+            json array = json::array();
+            for (std::size_t i = rng() % 5; i > 0; --i)
+            {
+                array.push_back(random_value(rng, depth + 1));
+            }
+            return array;
+        }
+        default:
+        {
+            json object = json::object();
+            for (std::size_t i = rng() % 6; i > 0; --i)
+            {
+                object[keys[rng() % 8]] = random_value(rng, depth + 1);
+            }
+            return object;
+        }
+    }
+}
+
+// decisions that only depend on what the callback sees outside skipped values
+bool keep(const int depth, const json::parse_event_t event, const json& parsed)
+{
+    switch (event)
+    {
+        case json::parse_event_t::key:
+            return parsed.get<std::string>()[0] != 'x';
+        case json::parse_event_t::object_start:
+            return depth != 3;
+        case json::parse_event_t::array_start:
+            return depth != 2;
+        case json::parse_event_t::value:
+            return parsed != 7;
+        case json::parse_event_t::object_end:
+            // parse_filtered has already removed discarded members here
+            return !parsed.contains("gone") || parsed.at("gone").is_discarded();
+        case json::parse_event_t::array_end:
+        default:
+            return true;
+    }
+}
+
+// remove the discarded values parse may leave behind
+void strip(json& value)
+{
+    if (value.is_object())
+    {
+        for (auto it = value.begin(); it != value.end();)
+        {
+            it = it->is_discarded() ? value.erase(it) : (strip(*it), std::next(it));
+        }
+    }
+    else if (value.is_array())
+    {
+        for (auto& element : value)
+        {
+            CHECK(!element.is_discarded());
+            strip(element);
+        }
+    }
+}
+
+bool has_discarded(const json& value)
+{
+    if (value.is_discarded())
+    {
+        return true;
+    }
+    if (value.is_structured())
+    {
+        for (const auto& element : value)
+        {
+            if (has_discarded(element))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void test_random()
+{
+    std::mt19937 rng(2024);
+    for (int i = 0; i < 20000; ++i)
+    {
+        const std::string text = random_value(rng, 0).dump(static_cast<int>(rng() % 2) - 1);
+        json expected = json::parse(text, keep);
+        strip(expected);
+
+        const json filtered = json::parse_filtered(text, keep);
+        CHECK(!has_discarded(filtered));
+        if (filtered != expected)
+        {
+            std::cerr << "mismatch for " << json::parse(text).dump() << "\n";
+            CHECK(filtered == expected);
+        }
+
+        std::istringstream stream(text);
+        CHECK(json::parse_filtered(stream, keep) == expected);
+        CHECK(json::parse_filtered(text.begin(), text.end(), keep) == expected);
+    }
+}
+
+void test_placeholders()
+{
+    // discarded scalars next to skipped members leave no placeholders
+    const char* const text = R"({"a": 7, "b": {"c": 7, "x": [1]}, "xs": {"y": 1}, "d": [7, {"e": 7}]})";
+    const json filtered = json::parse_filtered(text, keep);
+    CHECK(filtered == json::parse(R"({"b": {}, "d": [{}]})"));
+    CHECK(filtered.dump().find("discarded") == std::string::npos);
+}
+
+bool throws_parse_error(const std::string& text)
+{
+    try
+    {
+        const json result = json::parse_filtered(text, keep, true, true);
+        static_cast<void>(result);
+    }
+    catch (const json::parse_error& e)
+    {
+        return e.id == 101;
+    }
+    return false;
+}
+
+void test_skipped_errors()
+{
+    // the documented limits: skipped values are matched, not validated
+    CHECK(json::parse_filtered(R"({"x": [1,, tru], "a": 1})", keep) == json({{"a", 1}}));
+    CHECK(json::parse_filtered(R"({"x": {"k" "\q"}, "a": 1})", keep) == json({{"a", 1}}));
+
+    CHECK(throws_parse_error(R"({"x": [1})"));
+    CHECK(throws_parse_error(R"({"x": "abc)"));
+    CHECK(throws_parse_error(R"({"x": [1, /* open)"));
+    CHECK(throws_parse_error(R"({"x": [[1])"));
+    CHECK(!throws_parse_error(R"({"x": [1, /* ] */ 2], "a": 1})"));
+
+    // outside skipped values, errors are reported as by parse
+    CHECK(throws_parse_error(R"({"x": [1], "a": tru})"));
+    CHECK(json::parse_filtered(R"({"x": [1}, "a": 1})", keep, false).is_discarded());
+}
+
+}  // namespace
+
+int main()
+{
+    test_random();
+    test_placeholders();
+    test_skipped_errors();
+    return json_test::test_result("test_parse_filtered");
+}
@@ -0,0 +1,68 @@
+//     __ _____ _____ _____
+//  __|  |   __|     |   | |  JSON for Modern C++ (supporting code)
+// |  |  |__   |  |  | | | |  version 3.11.3
+// |_____|_____|_____|_|___|  https://github.com/nlohmann/json
+//
+// SPDX-FileCopyrightText: 2013 - 2025 Niels Lohmann <https://nlohmann.me>
+// SPDX-License-Identifier: MIT
+
+// parse_parallel must give the same result or error as parse, also for
+// elements that a parse of their own would read differently.
+
+#include "json.hpp"
+
+#include <string>
+
+#include "check.hpp"
+
+using nlohmann::json;
+
+namespace
+{
+
+// a top-level array large enough to be split
+std::string large_array()
+{
+    json array = json::array();
+    for (int i = 0; i < 40000; ++i)
+    {
+        array.push_back({{"id", i}, {"text", "a \"quoted\" [text], {with} brackets"}, {"list", {i, i + 1}}});
+    }
+    return array.dump();
+}
+
+// the same outcome as a serial parse, for 1, 2, and 4 threads
+void check_same(const std::string& text)
+{
+    const json expected = json::parse(text, nullptr, false);
+    for (const std::size_t threads : {1, 2, 4})
+    {
+        const json parsed = json::parse_parallel(text, threads, false);
+        CHECK(parsed.is_discarded() == expected.is_discarded());
+        CHECK(parsed.is_discarded() || parsed == expected);
+    }
+}
+
+}  // namespace
+
+int main()
+{
+    const std::string text = large_array();
+    check_same(text);
+
+    // an element that starts with a byte order mark
+    const std::size_t middle = text.find(",{", text.size() / 2);
+    std::string with_bom = text;
+    with_bom.insert(middle + 1, "\xEF\xBB\xBF");
+    check_same(with_bom);
+
+    // a null character between elements and within one
+    std::string with_null = text;
+    with_null.insert(middle + 1, std::string(1, '\0'));
+    check_same(with_null);
+    with_null = text;
+    with_null.insert(text.find("\"id\"", middle) + 5, std::string(1, '\0'));
+    check_same(with_null);
+
+    return json_test::test_result("test_parse_parallel");
+}
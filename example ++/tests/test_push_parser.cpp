@@ -0,0 +1,167 @@
+//     __ _____ _____ _____
+//  __|  |   __|     |   | |  JSON for Modern C++ (supporting code)
+// |  |  |__   |  |  | | | |  version 3.11.3
+// |_____|_____|_____|_|___|  https://github.com/nlohmann/json
+//
+// SPDX-FileCopyrightText: 2013 - 2025 Niels Lohmann <https://nlohmann.me>
+// SPDX-License-Identifier: MIT
+
+// push_parser must give the same values and errors as parse, however its
+// input is cut into chunks.
+
+#include "json.hpp"
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "check.hpp"
+
+using nlohmann::json;
+using nlohmann::push_parser;
+using nlohmann::push_parser_options;
+
+namespace
+{
+
+const char* const documents[] =
+{
+    R"({"id": 12345, "name": "a \"quoted\" name é😀", "tags": ["x", "y"], "score": -1.5e-3})",
+    R"([true, false, null, 0, -0, 18446744073709551615, -9223372036854775808, 1.7976931348623157e308])",
+    R"({"nested": [[[{"a": []}]], {}, "\\\\"], "empty": "", "long": "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"})",
+    R"(  /* comment */ [1, // line comment
+       2, /**/ 3] )",
+    R"(12345.678e9)",
+    R"("top-level string")",
+};
+
+// the value or the error that parse gives
+std::string outcome(const std::string& text, const bool ignore_comments)
+{
+    try
+    {
+        return json::parse(text, nullptr, true, ignore_comments).dump();
+    }
+    catch (const json::exception& e)
+    {
+        return e.what();
+    }
+}
+
+// the same through push_parser, fed in chunks that end at @a cuts
+std::string pushed_outcome(const std::string& text, const bool ignore_comments, const std::vector<std::size_t>& cuts)
+{
+    push_parser_options options;
+    options.ignore_comments = ignore_comments;
+    push_parser parser(options);
+    try
+    {
+        std::size_t start = 0;
+        for (const auto cut : cuts)
+        {
+            parser.feed(text.data() + start, text.data() + cut);
+            start = cut;
+        }
+        parser.feed(text.data() + start, text.data() + text.size());
+        parser.finish();
+        json result;
+        CHECK(parser.next(result));
+        return result.dump();
+    }
+    catch (const json::exception& e)
+    {
+        return e.what();
+    }
+}
+
+std::vector<std::size_t> random_cuts(std::mt19937& rng, const std::size_t size)
+{
+    std::vector<std::size_t> cuts;
+    std::size_t position = 0;
+    while (position < size)
+    {
+        // mostly short chunks, so that tokens are cut, and some empty ones
+        position = (std::min)(size, position + (rng() % 4 == 0 ? rng() % 40 : rng() % 4));
+        cuts.push_back(position);
+    }
+    return cuts;
+}
+
+void test_every_cut()
+{
+    for (const char* document : documents)
+    {
+        const std::string text = document;
+        const std::string expected = outcome(text, true);
+        for (std::size_t first = 0; first <= text.size(); ++first)
+        {
+            for (std::size_t second = first; second <= text.size(); ++second)
+            {
+                const std::string pushed = pushed_outcome(text, true, {first, second});
+                if (pushed != expected)
+                {
+                    std::cerr << "mismatch for " << text << " cut at " << first << " and " << second << "\n";
+                    CHECK(pushed == expected);
+                }
+            }
+        }
+    }
+}
+
+void test_corrupted()
+{
+    std::mt19937 rng(68);
+    for (int i = 0; i < 20000; ++i)
+    {
+        std::string text = documents[rng() % (sizeof(documents) / sizeof(documents[0]))];
+        for (std::size_t n = rng() % 3; n > 0; --n)
+        {
+            text[rng() % text.size()] = "{}[]\",:\\/*0e.-tn \n"[rng() % 18];
+        }
+        const bool ignore_comments = rng() % 2 == 0;
+        CHECK(pushed_outcome(text, ignore_comments, random_cuts(rng, text.size())) == outcome(text, ignore_comments));
+    }
+}
+
+void test_multiple_values()
+{
+    std::string text;
+    std::vector<json> expected;
+    for (int i = 0; i < 2000; ++i)
+    {
+        expected.push_back({{"i", i}, {"s", std::string(static_cast<std::size_t>(i % 50), 'x')}, {"f", i * 0.25}});
+        text += expected.back().dump() + "\n";
+    }
+
+    std::mt19937 rng(2);
+    push_parser_options options;
+    options.multiple_values = true;
+    push_parser parser(options);
+    std::size_t start = 0;
+    for (const auto cut : random_cuts(rng, text.size()))
+    {
+        CHECK(parser.feed(text.data() + start, text.data() + cut));
+        start = cut;
+    }
+    CHECK(parser.finish());
+    CHECK(parser.values_read() == expected.size());
+
+    json value;
+    std::size_t index = 0;
+    while (parser.next(value))
+    {
+        CHECK(index < expected.size() && value == expected[index]);
+        ++index;
+    }
+    CHECK(index == expected.size());
+}
+
+}  // namespace
+
+int main()
+{
+    test_every_cut();
+    test_corrupted();
+    test_multiple_values();
+    return json_test::test_result("test_push_parser");
+}
@@ -0,0 +1,84 @@
+//     __ _____ _____ _____
+//  __|  |   __|     |   | |  JSON for Modern C++ (supporting code)
+// |  |  |__   |  |  | | | |  version 3.11.3
+// |_____|_____|_____|_|___|  https://github.com/nlohmann/json
+//
+// SPDX-FileCopyrightText: 2013 - 2025 Niels Lohmann <https://nlohmann.me>
+// SPDX-License-Identifier: MIT
+
+// raw() must only accept text that can be written into another document
+// verbatim, and dump() must honor ensure_ascii for it.
+
+#include "json.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "check.hpp"
+
+using nlohmann::json;
+
+namespace
+{
+
+bool rejected(const std::string& text)
+{
+    try
+    {
+        const json j = json::raw(text);
+        static_cast<void>(j);
+    }
+    catch (const json::parse_error& e)
+    {
+        return e.id == 101;
+    }
+    return false;
+}
+
+void test_validation()
+{
+    CHECK(!rejected(" [1, 2] "));
+    CHECK(!rejected("\"\xC3\xA9\""));
+    CHECK(rejected(""));
+    CHECK(rejected("[1] 2"));
+    CHECK(rejected(std::string("1\0 2", 4)));
+    CHECK(rejected(std::string("[1]\0", 4)));
+    CHECK(rejected("\xEF\xBB\xBF[1]"));
+}
+
+void test_dump()
+{
+    const json value = {{"text", json::raw("[ \"\xC3\xA9\", 1 ]")}, {"plain", json::raw("[ 1 ]")}};
+    CHECK(value.dump() == "{\"plain\":[ 1 ],\"text\":[ \"\xC3\xA9\", 1 ]}");
+    // non-ASCII text is written like the parsed value; ASCII text stays verbatim
+    CHECK(value.dump(-1, ' ', true) == "{\"plain\":[ 1 ],\"text\":[\"\\u00e9\",1]}");
+    CHECK(value.dump(2, ' ', true) == "{\n  \"plain\": [ 1 ],\n  \"text\": [\n    \"\\u00e9\",\n    1\n  ]\n}");
+}
+
+void test_reading()
+{
+    const json value = json::raw("{\"a\": [1, 2]}");
+    CHECK(value.is_raw());
+    CHECK(value == json({{"a", {1, 2}}}));
+    CHECK(std::hash<json> {}(value) == std::hash<json> {}(json::parse("{\"a\": [1, 2]}")));
+    const auto parsed = value.get<std::map<std::string, std::vector<int>>>();
+    CHECK(parsed.at("a").size() == 2);
+
+    json copy = value;
+    copy.parse_raw();
+    CHECK(copy.is_object() && copy == value);
+
+    // raw is the last type, so the existing ones keep their numbers
+    CHECK(static_cast<int>(json::value_t::raw) == static_cast<int>(json::value_t::discarded) + 1);
+}
+
+}  // namespace
+
+int main()
+{
+    test_validation();
+    test_dump();
+    test_reading();
+    return json_test::test_result("test_raw");
+}
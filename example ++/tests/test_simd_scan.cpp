@@ -0,0 +1,290 @@
+//     __ _____ _____ _____
+//  __|  |   __|     |   | |  JSON for Modern C++ (supporting code)
+// |  |  |__   |  |  | | | |  version 3.11.3
+// |_____|_____|_____|_|___|  https://github.com/nlohmann/json
+//
+// SPDX-FileCopyrightText: 2013 - 2025 Niels Lohmann <https://nlohmann.me>
+// SPDX-License-Identifier: MIT
+
+// Differential tests of detail::simd_scan and the lexer's bulk paths against
+// byte-by-byte references. Built twice: with the SIMD code and with
+// JSON_DISABLE_SIMD=1.
+
+#include "json.hpp"
+
+#include <cstddef>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "check.hpp"
+
+using nlohmann::json;
+using nlohmann::detail::simd_scan;
+
+namespace
+{
+
+const char* reference_string_special(const char* first, const char* last)
+{
+    for (; first != last; ++first)
+    {
+        const auto c = static_cast<unsigned char>(*first);
+        if (c == '\"' || c == '\\' || c < 0x20 || c >= 0x80)
+        {
+            break;
+        }
+    }
+    return first;
+}
+
+// the length of the well-formed UTF-8 sequence at first (RFC 3629, table 3-7 of the Unicode standard), or 0
+std::size_t reference_utf8_length(const unsigned char* first, const unsigned char* last)
+{
+    const auto available = static_cast<std::size_t>(last - first);
+    const unsigned char c = first[0];
+    std::size_t length = 0;
+    unsigned char low = 0x80;
+    unsigned char high = 0xBF;
+    if (c >= 0xC2 && c <= 0xDF)
+    {
+        length = 2;
+    }
+    else if (c >= 0xE0 && c <= 0xEF)
+    {
+        length = 3;
+        low = c == 0xE0 ? 0xA0 : 0x80;
+        high = c == 0xED ? 0x9F : 0xBF;
+    }
+    else if (c >= 0xF0 && c <= 0xF4)
+    {
+        length = 4;
+        low = c == 0xF0 ? 0x90 : 0x80;
+        high = c == 0xF4 ? 0x8F : 0xBF;
+    }
+    if (length == 0 || available < length || first[1] < low || first[1] > high)
+    {
+        return 0;
+    }
+    for (std::size_t i = 2; i < length; ++i)
+    {
+        if (first[i] < 0x80 || first[i] > 0xBF)
+        {
+            return 0;
+        }
+    }
+    return length;
+}
+
+const char* reference_string_special_utf8(const char* first, const char* last)
+{
+    while (first != last)
+    {
+        const auto c = static_cast<unsigned char>(*first);
+        if (c == '\"' || c == '\\' || c < 0x20)
+        {
+            break;
+        }
+        if (c < 0x80)
+        {
+            ++first;
+            continue;
+        }
+        const auto length = reference_utf8_length(reinterpret_cast<const unsigned char*>(first),
+                            reinterpret_cast<const unsigned char*>(last));
+        if (length == 0)
+        {
+            break;
+        }
+        first += length;
+    }
+    return first;
+}
+
+const char* reference_non_whitespace(const char* first, const char* last)
+{
+    while (first != last && (*first == ' ' || *first == '\t' || *first == '\n' || *first == '\r'))
+    {
+        ++first;
+    }
+    return first;
+}
+
+const char* reference_structural(const char* first, const char* last)
+{
+    while (first != last && std::string("{}[]:,\"").find(*first) == std::string::npos)
+    {
+        ++first;
+    }
+    return first;
+}
+
+// bytes that exercise every class the scanners distinguish
+std::string random_bytes(std::mt19937& rng, const std::size_t length, const int flavor)
+{
+    static const std::vector<std::string> pieces =
+    {
+        "a", "Z", "0", " ", "\t", "\n", "\r", "\"", "\\", "{", "}", "[", "]", ":", ",", "\x01", "\x1F", "\x7F",
+        "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80", "\xED\x9F\xBF", "\xF4\x8F\xBF\xBF",
+        "\xC0\xAF", "\xC1", "\xED\xA0\x80", "\xE0\x80\x80", "\xF4\x90\x80\x80", "\xF5", "\xFF", "\x80", "\xBF",
+        "\xE2\x82", "\xF0\x9F\x98",
+    };
+    std::string result;
+    while (result.size() < length)
+    {
+        const auto r = rng() % 100;
+        if (flavor == 0 || r < 70)
+        {
+            // long plain runs, so the vector loops are used
+            result += (flavor == 2) ? ' ' : static_cast<char>('a' + rng() % 26);
+        }
+        else
+        {
+            result += pieces[rng() % pieces.size()];
+        }
+    }
+    result.resize(length);
+    return result;
+}
+
+void test_scanners()
+{
+    std::mt19937 rng(20240117);
+    for (int round = 0; round < 3000; ++round)
+    {
+        const std::string bytes = random_bytes(rng, rng() % 200, round % 3);
+        const char* const data = bytes.data();
+        const char* const end = data + bytes.size();
+
+        // every start offset, so that all alignments and tail lengths are covered
+        for (std::size_t offset = 0; offset <= bytes.size(); ++offset)
+        {
+            const char* first = data + offset;
+            CHECK(simd_scan::find_string_special(first, end) == reference_string_special(first, end));
+            CHECK(simd_scan::find_string_special_utf8(first, end) == reference_string_special_utf8(first, end));
+            CHECK(simd_scan::find_non_whitespace(first, end) == reference_non_whitespace(first, end));
+            CHECK(simd_scan::find_structural(first, end) == reference_structural(first, end));
+        }
+    }
+}
+
+// a JSON text, valid unless mutated, with long strings and whitespace runs
+std::string random_document(std::mt19937& rng, const int depth)
+{
+    const auto whitespace = [&rng]()
+    {
+        return random_bytes(rng, rng() % 3 == 0 ? rng() % 70 : 0, 2);
+    };
+    const auto string = [&rng]()
+    {
+        std::string s = "\"";
+        const auto length = rng() % 120;
+        while (s.size() < length)
+        {
+            switch (rng() % 12)
+            {
+                case 0:
+                    s += "\\n";
+                    break;
+                case 1:
+                    s += "\\u00e9\\ud83d\\ude00";
+                    break;
+                case 2:
+                    s += "\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80";
+                    break;
+                default:
+                    s += random_bytes(rng, rng() % 40, 0);
+                    break;
+            }
+        }
+        return s + "\"";
+    };
+
+    std::string result = whitespace();
+    switch (depth > 3 ? rng() % 3 : rng() % 5)
+    {
+        case 0:
+            result += string();
+            break;
+        case 1:
+            result += std::to_string(static_cast<int>(rng() % 100000) - 50000);
+            break;
+        case 2:
+            result += (rng() % 2) ? "true" : "null";
+            break;
+        case 3:
+        {
+            result += "[";
+            const auto n = rng() % 5;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                result += (i != 0 ? "," : "") + random_document(rng, depth + 1);
+            }
+            result += whitespace() + "]";
+            break;
+        }
+        default:
+        {
+            result += "{";
+            const auto n = rng() % 5;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                result += (i != 0 ? "," : "") + whitespace() + string() + whitespace() + ":" + random_document(rng, depth + 1);
+            }
+            result += whitespace() + "}";
+            break;
+        }
+    }
+    return result + whitespace();
+}
+
+// the outcome of parsing: the serialized value or the exception message
+template<typename Iterator>
+std::string parse_outcome(Iterator first, Iterator last)
+{
+    try
+    {
+        return json::parse(first, last).dump();
+    }
+    catch (const json::exception& e)
+    {
+        return std::string("error: ") + e.what();
+    }
+}
+
+void test_lexer()
+{
+    static const char mutations[] = {'\"', '\\', '\x01', '\x80', '\xC3', '\xED', '\xFF', ' ', 'x', '\0'};
+
+    std::mt19937 rng(77);
+    std::size_t errors = 0;
+    for (int round = 0; round < 4000; ++round)
+    {
+        std::string document = random_document(rng, 0);
+        if (round % 2 == 1 && !document.empty())
+        {
+            document[rng() % document.size()] = mutations[rng() % sizeof(mutations)];
+        }
+
+        // contiguous input takes the bulk paths; std::list input is read byte by byte
+        const std::list<char> bytes(document.begin(), document.end());
+        const std::string contiguous = parse_outcome(document.data(), document.data() + document.size());
+        CHECK(contiguous == parse_outcome(bytes.begin(), bytes.end()));
+        CHECK(contiguous == parse_outcome(document.begin(), document.end()));
+        errors += contiguous.compare(0, 7, "error: ") == 0 ? 1 : 0;
+    }
+
+    // both valid and invalid documents were compared
+    CHECK(errors > 500);
+    CHECK(errors < 3500);
+}
+
+}  // namespace
+
+int main()
+{
+    test_scanners();
+    test_lexer();
+    return json_test::test_result("test_simd_scan");
+}
@@ -0,0 +1,143 @@
+//     __ _____ _____ _____
+//  __|  |   __|     |   | |  JSON for Modern C++ (supporting code)
+// |  |  |__   |  |  | | | |  version 3.11.3
+// |_____|_____|_____|_|___|  https://github.com/nlohmann/json
+//
+// SPDX-FileCopyrightText: 2013 - 2025 Niels Lohmann <https://nlohmann.me>
+// SPDX-License-Identifier: MIT
+
+// The member lists generated by the NLOHMANN_DEFINE_* macros must only be used
+// for exactly the type they were generated for: derived types use their own
+// (chained to the base) or fall back to their own from_json and to_json.
+
+#include "json.hpp"
+
+#include <string>
+#include <vector>
+
+#include "check.hpp"
+
+using nlohmann::json;
+
+namespace fields
+{
+
+struct base
+{
+    int a = 0;
+    NLOHMANN_DEFINE_TYPE_INTRUSIVE(base, a)
+};
+
+// derived without a macro, with its own conversions
+struct custom : base
+{
+    int b = 0;
+};
+
+inline void from_json(const json& j, custom& value)
+{
+    value.a = j.at("a").get<int>() * 10;
+    value.b = j.at("b").get<int>();
+}
+
+inline void to_json(json& j, const custom& value)
+{
+    j = {{"a", value.a}, {"b", value.b}, {"custom", true}};
+}
+
+struct derived : base
+{
+    std::string c;
+    NLOHMANN_DEFINE_DERIVED_TYPE_INTRUSIVE(derived, base, c)
+};
+
+struct derived_with_default : base
+{
+    int d = 7;
+};
+
+NLOHMANN_DEFINE_DERIVED_TYPE_NON_INTRUSIVE_WITH_DEFAULT(derived_with_default, base, d)
+
+// a member that hides a base member of the same name
+struct shadowing : base
+{
+    std::string a = "derived";
+    NLOHMANN_DEFINE_DERIVED_TYPE_INTRUSIVE_ONLY_SERIALIZE(shadowing, base, a)
+};
+
+}  // namespace fields
+
+namespace
+{
+
+template<typename T>
+bool throws_403(const char* text)
+{
+    std::vector<T> values;
+    try
+    {
+        json::parse_into(values, text);
+    }
+    catch (const json::out_of_range& e)
+    {
+        return e.id == 403;
+    }
+    return false;
+}
+
+void test_parse_into()
+{
+    std::vector<fields::custom> custom;
+    json::parse_into(custom, R"([{"a": 1, "b": 2}])");
+    CHECK(custom.size() == 1 && custom[0].a == 10 && custom[0].b == 2);
+
+    std::vector<fields::derived> derived;
+    json::parse_into(derived, R"([{"c": "x", "a": 1, "unknown": [1]}])");
+    CHECK(derived.size() == 1 && derived[0].a == 1 && derived[0].c == "x");
+    CHECK(throws_403<fields::derived>(R"([{"c": "x"}])"));
+    CHECK(throws_403<fields::derived>(R"([{"a": 1}])"));
+
+    std::vector<fields::derived_with_default> with_default;
+    json::parse_into(with_default, R"([{"a": 4}])");
+    CHECK(with_default.size() == 1 && with_default[0].a == 4 && with_default[0].d == 7);
+    CHECK(throws_403<fields::derived_with_default>(R"([{"d": 1}])"));
+}
+
+template<typename T>
+void check_dump_value(const T& value)
+{
+    CHECK(json::dump_value(value) == json(value).dump());
+    CHECK(json::dump_value(value, 2) == json(value).dump(2));
+    CHECK(nlohmann::ordered_json::dump_value(value) == nlohmann::ordered_json(value).dump());
+}
+
+void test_dump_value()
+{
+    fields::custom custom;
+    custom.a = 1;
+    custom.b = 2;
+    check_dump_value(custom);
+    CHECK(json::dump_value(custom) == R"({"a":1,"b":2,"custom":true})");
+
+    fields::derived derived;
+    derived.a = 3;
+    derived.c = "x";
+    check_dump_value(derived);
+    check_dump_value(std::vector<fields::derived> {derived, derived});
+
+    fields::derived_with_default with_default;
+    check_dump_value(with_default);
+
+    fields::shadowing shadowing;
+    check_dump_value(shadowing);
+    CHECK(json::dump_value(shadowing) == R"({"a":"derived"})");
+}
+
+}  // namespace
+
+int main()
+{
+    test_parse_into();
+    test_dump_value();
+    return json_test::test_result("test_struct_fields");
+}